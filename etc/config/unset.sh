@@ -52,6 +52,7 @@ unset WM_CC
 unset WM_CFLAGS
 unset WM_COMPILER
 unset WM_COMPILER_LIB_ARCH
+unset WM_THRUST_DEVICE_SYSTEM
 unset WM_COMPILE_OPTION
 unset WM_CXX
 unset WM_CXXFLAGS